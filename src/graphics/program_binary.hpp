@@ -0,0 +1,127 @@
+// Saving and restoring linked shader programs, for SF::ShaderCache.
+//
+// Uses GL_ARB_get_program_binary (core in OpenGL 4.1) when the driver
+// supports at least one binary format; otherwise every function here
+// reports failure and the shaders are compiled as usual.
+
+#ifndef CRSFML_PROGRAM_BINARY_HPP
+#define CRSFML_PROGRAM_BINARY_HPP
+
+#include <string>
+#include "uniforms.hpp"
+
+#define _CRSFML_GL_VENDOR 0x1F00
+#define _CRSFML_GL_RENDERER 0x1F01
+#define _CRSFML_GL_VERSION 0x1F02
+#define _CRSFML_GL_LINK_STATUS 0x8B82
+#define _CRSFML_GL_PROGRAM_BINARY_LENGTH 0x8741
+#define _CRSFML_GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#define _CRSFML_GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+
+struct _ProgramBinaryFunctions {
+    const unsigned char* (_CRSFML_GLAPI *getString)(unsigned int);
+    void (_CRSFML_GLAPI *getIntegerv)(unsigned int, int*);
+    void (_CRSFML_GLAPI *getProgramiv)(unsigned int, unsigned int, int*);
+    void (_CRSFML_GLAPI *getProgramBinary)(unsigned int, int, int*, unsigned int*, void*);
+    void (_CRSFML_GLAPI *programBinary)(unsigned int, unsigned int, const void*, int);
+    void (_CRSFML_GLAPI *programParameteri)(unsigned int, unsigned int, int);
+    void (_CRSFML_GLAPI *linkProgram)(unsigned int);
+
+    // Load the functions on first use; a context must be active.
+    // `programBinary` stays null if program binaries aren't supported.
+    static const _ProgramBinaryFunctions& get() {
+        static _ProgramBinaryFunctions gl;
+        static bool loaded = false;
+        static sf::Mutex mutex;
+        sf::Lock lock(mutex);
+        if (!loaded) {
+            gl.getString = (const unsigned char* (_CRSFML_GLAPI *)(unsigned int))sf::Context::getFunction("glGetString");
+            gl.getIntegerv = (void (_CRSFML_GLAPI *)(unsigned int, int*))sf::Context::getFunction("glGetIntegerv");
+            gl.getProgramiv = (void (_CRSFML_GLAPI *)(unsigned int, unsigned int, int*))sf::Context::getFunction("glGetProgramiv");
+            gl.getProgramBinary = (void (_CRSFML_GLAPI *)(unsigned int, int, int*, unsigned int*, void*))sf::Context::getFunction("glGetProgramBinary");
+            gl.programBinary = (void (_CRSFML_GLAPI *)(unsigned int, unsigned int, const void*, int))sf::Context::getFunction("glProgramBinary");
+            gl.programParameteri = (void (_CRSFML_GLAPI *)(unsigned int, unsigned int, int))sf::Context::getFunction("glProgramParameteri");
+            gl.linkProgram = (void (_CRSFML_GLAPI *)(unsigned int))sf::Context::getFunction("glLinkProgram");
+            int formats = 0;
+            if (gl.getIntegerv)
+                gl.getIntegerv(_CRSFML_GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            if (formats <= 0 || !gl.getProgramiv || !gl.getProgramBinary || !gl.programParameteri || !gl.linkProgram) {
+                gl.getProgramBinary = 0;
+                gl.programBinary = 0;
+            }
+            loaded = true;
+        }
+        return gl;
+    }
+};
+
+// Vendor, renderer and version of the OpenGL driver; binaries are only
+// valid for the driver that produced them
+inline std::string _gl_driver() {
+    _GlResourceAccess::TransientContextLock lock;
+    const _ProgramBinaryFunctions& gl = _ProgramBinaryFunctions::get();
+    std::string result;
+    if (!gl.getString)
+        return result;
+    const unsigned int names[] = {_CRSFML_GL_VENDOR, _CRSFML_GL_RENDERER, _CRSFML_GL_VERSION};
+    for (int i = 0; i < 3; ++i) {
+        const unsigned char* str = gl.getString(names[i]);
+        if (str)
+            result += (const char*)str;
+        result += '\n';
+    }
+    return result;
+}
+
+// Copy the binary of the shader's program into `data` (at most `capacity`
+// bytes) and return its size; with a null `data`, only return the size.
+// Returns 0 if there is no binary.
+//
+// Drivers only have to keep a binary of programs that were linked with
+// GL_PROGRAM_BINARY_RETRIEVABLE_HINT, but SFML links the program inside
+// `loadFromMemory` without it. So the size query first sets the hint and
+// links the program again; this is done right after loading, before any
+// uniform is set, so nothing is lost.
+inline std::size_t _program_binary(const sf::Shader& shader, unsigned int* format, void* data, std::size_t capacity) {
+    unsigned int program = shader.getNativeHandle();
+    if (!program)
+        return 0;
+    _GlResourceAccess::TransientContextLock lock;
+    const _ProgramBinaryFunctions& gl = _ProgramBinaryFunctions::get();
+    if (!gl.getProgramBinary)
+        return 0;
+    if (!data) {
+        gl.programParameteri(program, _CRSFML_GL_PROGRAM_BINARY_RETRIEVABLE_HINT, 1);
+        gl.linkProgram(program);
+        int linked = 0;
+        gl.getProgramiv(program, _CRSFML_GL_LINK_STATUS, &linked);
+        if (!linked)
+            return 0;
+    }
+    int length = 0;
+    gl.getProgramiv(program, _CRSFML_GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0 || !data)
+        return length > 0 ? (std::size_t)length : 0;
+    if ((std::size_t)length > capacity)
+        return 0;
+    gl.getProgramBinary(program, length, &length, format, data);
+    return length > 0 ? (std::size_t)length : 0;
+}
+
+// Replace the shader's program with a binary from `_program_binary`;
+// returns false if the driver rejects it
+inline bool _load_program_binary(const sf::Shader& shader, unsigned int format, const void* data, std::size_t size) {
+    unsigned int program = shader.getNativeHandle();
+    if (!program)
+        return false;
+    _GlResourceAccess::TransientContextLock lock;
+    const _ProgramBinaryFunctions& gl = _ProgramBinaryFunctions::get();
+    if (!gl.programBinary)
+        return false;
+    gl.programBinary(program, format, data, (int)size);
+    int linked = 0;
+    gl.getProgramiv(program, _CRSFML_GL_LINK_STATUS, &linked);
+    return linked != 0;
+}
+
+#endif
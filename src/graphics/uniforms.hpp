@@ -0,0 +1,111 @@
+// Setting shader uniforms by location, for SF::Shader#uniform.
+//
+// Shader::setParameter looks the location up by name on every call, and
+// binds and unbinds the program around each value. These functions let the
+// location be looked up once, and set any number of values with a single
+// bind, calling OpenGL directly (loaded through Context::getFunction, like
+// SFML does internally).
+
+#ifndef CRSFML_UNIFORMS_HPP
+#define CRSFML_UNIFORMS_HPP
+
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/GlResource.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+
+#if defined(_WIN32) && !defined(_WIN64)
+#define _CRSFML_GLAPI __stdcall
+#else
+#define _CRSFML_GLAPI
+#endif
+
+#define _CRSFML_GL_CURRENT_PROGRAM 0x8B8D
+
+// One value to set (the layout must match SFMLExt::UniformValue):
+// `size` floats, or a 4x4 matrix if `size` is 16
+struct _UniformValue {
+    int location;
+    int size;
+    float values[16];
+};
+
+// GlResource::TransientContextLock is protected; this makes it nameable
+class _GlResourceAccess : public sf::GlResource {
+public:
+    using sf::GlResource::TransientContextLock;
+};
+
+struct _UniformFunctions {
+    int (_CRSFML_GLAPI *getUniformLocation)(unsigned int, const char*);
+    void (_CRSFML_GLAPI *getIntegerv)(unsigned int, int*);
+    void (_CRSFML_GLAPI *useProgram)(unsigned int);
+    void (_CRSFML_GLAPI *uniform1f)(int, float);
+    void (_CRSFML_GLAPI *uniform2f)(int, float, float);
+    void (_CRSFML_GLAPI *uniform3f)(int, float, float, float);
+    void (_CRSFML_GLAPI *uniform4f)(int, float, float, float, float);
+    void (_CRSFML_GLAPI *uniformMatrix4fv)(int, int, unsigned char, const float*);
+
+    // Load the functions on first use; a context must be active
+    static const _UniformFunctions& get() {
+        static _UniformFunctions gl;
+        static bool loaded = false;
+        static sf::Mutex mutex;
+        sf::Lock lock(mutex);
+        if (!loaded) {
+            gl.getUniformLocation = (int (_CRSFML_GLAPI *)(unsigned int, const char*))sf::Context::getFunction("glGetUniformLocation");
+            gl.getIntegerv = (void (_CRSFML_GLAPI *)(unsigned int, int*))sf::Context::getFunction("glGetIntegerv");
+            gl.useProgram = (void (_CRSFML_GLAPI *)(unsigned int))sf::Context::getFunction("glUseProgram");
+            gl.uniform1f = (void (_CRSFML_GLAPI *)(int, float))sf::Context::getFunction("glUniform1f");
+            gl.uniform2f = (void (_CRSFML_GLAPI *)(int, float, float))sf::Context::getFunction("glUniform2f");
+            gl.uniform3f = (void (_CRSFML_GLAPI *)(int, float, float, float))sf::Context::getFunction("glUniform3f");
+            gl.uniform4f = (void (_CRSFML_GLAPI *)(int, float, float, float, float))sf::Context::getFunction("glUniform4f");
+            gl.uniformMatrix4fv = (void (_CRSFML_GLAPI *)(int, int, unsigned char, const float*))sf::Context::getFunction("glUniformMatrix4fv");
+            loaded = true;
+        }
+        return gl;
+    }
+};
+
+// Location of the uniform `name` in the shader, or -1 if there is none
+inline int _uniform_location(const sf::Shader& shader, const char* name) {
+    unsigned int program = shader.getNativeHandle();
+    if (!program)
+        return -1;
+    _GlResourceAccess::TransientContextLock lock;
+    const _UniformFunctions& gl = _UniformFunctions::get();
+    if (!gl.getUniformLocation)
+        return -1;
+    return gl.getUniformLocation(program, name);
+}
+
+// Set all the `values` with the shader's program bound once
+inline void _set_uniforms(const sf::Shader& shader, const _UniformValue* values, std::size_t count) {
+    unsigned int program = shader.getNativeHandle();
+    if (!program || !count)
+        return;
+    _GlResourceAccess::TransientContextLock lock;
+    const _UniformFunctions& gl = _UniformFunctions::get();
+    if (!gl.useProgram)
+        return;
+
+    int previous = 0;
+    gl.getIntegerv(_CRSFML_GL_CURRENT_PROGRAM, &previous);
+    if ((unsigned int)previous != program)
+        gl.useProgram(program);
+    for (std::size_t i = 0; i < count; ++i) {
+        const _UniformValue& v = values[i];
+        switch (v.size) {
+        case 1: gl.uniform1f(v.location, v.values[0]); break;
+        case 2: gl.uniform2f(v.location, v.values[0], v.values[1]); break;
+        case 3: gl.uniform3f(v.location, v.values[0], v.values[1], v.values[2]); break;
+        case 4: gl.uniform4f(v.location, v.values[0], v.values[1], v.values[2], v.values[3]); break;
+        case 16: gl.uniformMatrix4fv(v.location, 1, 0, v.values); break;
+        }
+    }
+    if ((unsigned int)previous != program)
+        gl.useProgram(previous);
+}
+
+#endif
@@ -0,0 +1,75 @@
+// Instrumentation of the C++ wrapper functions, for finding hot bindings.
+//
+// Compiled with -DCRSFML_INSTRUMENT (which needs C++11), every wrapper
+// function counts its calls; with -DCRSFML_INSTRUMENT_TIMING as well, it
+// also adds up the time spent in it, in timestamp counter ticks on x86 and
+// nanoseconds elsewhere. Without these, CRSFML_PROBE() compiles to nothing.
+//
+// The counters are read from Crystal through SF::Instrumentation.
+
+#ifndef CRSFML_INSTRUMENT_HPP
+#define CRSFML_INSTRUMENT_HPP
+
+#ifdef CRSFML_INSTRUMENT
+
+#include <atomic>
+
+// The counters of one function, in a list shared by all the modules
+// (the layout must match SFMLExt::Probe)
+struct _Probe {
+    _Probe* next;
+    const char* name;
+    std::atomic<unsigned long long> calls;
+    std::atomic<unsigned long long> ticks;
+
+    _Probe(const char* name) : next(0), name(name), calls(0), ticks(0) {
+        std::atomic<_Probe*>& head = list();
+        next = head.load();
+        while (!head.compare_exchange_weak(next, this)) {}
+    }
+
+    static std::atomic<_Probe*>& list() {
+        static std::atomic<_Probe*> head(0);
+        return head;
+    }
+};
+
+#ifdef CRSFML_INSTRUMENT_TIMING
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define _CRSFML_TICKS() __rdtsc()
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define _CRSFML_TICKS() __rdtsc()
+#else
+#include <chrono>
+#define _CRSFML_TICKS() (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>( \
+    std::chrono::steady_clock::now().time_since_epoch()).count()
+#endif
+
+struct _ProbeTimer {
+    _Probe& probe;
+    unsigned long long start;
+
+    _ProbeTimer(_Probe& probe) : probe(probe), start(_CRSFML_TICKS()) {}
+    ~_ProbeTimer() {
+        probe.ticks.fetch_add(_CRSFML_TICKS() - start, std::memory_order_relaxed);
+    }
+};
+#define _CRSFML_TIME(probe) _ProbeTimer _probe_timer(probe)
+#else
+#define _CRSFML_TIME(probe) (void)0
+#endif
+
+#define CRSFML_PROBE() \
+    static _Probe _probe(__FUNCTION__); \
+    _probe.calls.fetch_add(1, std::memory_order_relaxed); \
+    _CRSFML_TIME(_probe)
+
+#else
+
+#define CRSFML_PROBE() (void)0
+
+#endif
+
+#endif
@@ -0,0 +1,96 @@
+// Address lookups on a separate thread, for SF::Resolver.
+//
+// IpAddress(std::string) and IpAddress::getPublicAddress block the calling
+// thread until the system's resolver (or the web server) answers. Here they
+// run on an sf::Thread, which runs no Crystal code, and Crystal polls for
+// the answer, so the fibers keep running in the meantime.
+
+#ifndef CRSFML_LOOKUP_HPP
+#define CRSFML_LOOKUP_HPP
+
+#include <string>
+#include <vector>
+#include <SFML/Network/IpAddress.hpp>
+#include <SFML/System/Thread.hpp>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+
+class _Lookup {
+public:
+    // Start looking up `host`, or the public address if `host` is null
+    static _Lookup* start(const char* host, std::size_t host_size, sf::Time timeout) {
+        reap();
+        _Lookup* lookup = new _Lookup(host, host_size, timeout);
+        lookup->m_thread.launch();
+        return lookup;
+    }
+
+    // Returns true and sets `*address` once the answer is known
+    bool poll(sf::IpAddress* address) {
+        sf::Lock lock(m_mutex);
+        if (m_done)
+            *address = m_address;
+        return m_done;
+    }
+
+    // The lookup isn't needed anymore; it's deleted right away if it's
+    // finished, otherwise by a later `start` once its thread is done
+    void release() {
+        {
+            sf::Lock lock(m_mutex);
+            m_released = true;
+            if (!m_done)
+                return;
+        }
+        delete this;
+    }
+
+private:
+    _Lookup(const char* host, std::size_t host_size, sf::Time timeout) :
+    m_public(!host), m_host(host ? std::string(host, host_size) : std::string()), m_timeout(timeout),
+    m_done(false), m_released(false), m_thread(&_Lookup::run, this) {
+    }
+
+    void run() {
+        sf::IpAddress address = m_public ? sf::IpAddress::getPublicAddress(m_timeout) : sf::IpAddress(m_host);
+        sf::Lock lock(m_mutex);
+        m_address = address;
+        m_done = true;
+        if (m_released) {
+            sf::Lock finished_lock(finishedMutex());
+            finished().push_back(this);
+        }
+    }
+
+    // Delete the released lookups whose thread is done
+    static void reap() {
+        std::vector<_Lookup*> lookups;
+        {
+            sf::Lock lock(finishedMutex());
+            lookups.swap(finished());
+        }
+        for (std::size_t i = 0; i < lookups.size(); ++i)
+            delete lookups[i];
+    }
+
+    static std::vector<_Lookup*>& finished() {
+        static std::vector<_Lookup*> lookups;
+        return lookups;
+    }
+    static sf::Mutex& finishedMutex() {
+        static sf::Mutex mutex;
+        return mutex;
+    }
+
+    bool m_public;
+    std::string m_host;
+    sf::Time m_timeout;
+    sf::IpAddress m_address;
+    bool m_done;
+    bool m_released;
+    sf::Mutex m_mutex;
+    // Last, so that it's destroyed first: that waits for `run` to return
+    sf::Thread m_thread;
+};
+
+#endif
@@ -0,0 +1,134 @@
+// Memory for the wrapped objects.
+//
+// Each type has a free list of blocks of its size, so objects that are
+// created and destroyed all the time (e.g. a shape per frame) reuse memory
+// instead of going through malloc. The free lists and the counters are
+// per thread, so taking and returning a block needs no lock and no atomic
+// operation. Each thread keeps at most _POOL_MAX_FREE blocks per type; the
+// rest are freed. (The blocks kept by a thread that exits aren't reused.)
+//
+// The number of live objects of each type is read from Crystal through
+// SF::Pool.
+
+#ifndef CRSFML_POOL_HPP
+#define CRSFML_POOL_HPP
+
+#include <cstdlib>
+#include <cstddef>
+#include <SFML/System/Mutex.hpp>
+#include <SFML/System/Lock.hpp>
+
+#define _POOL_MAX_FREE 64
+
+#if defined(_MSC_VER)
+#define _POOL_THREAD_LOCAL __declspec(thread)
+#else
+#define _POOL_THREAD_LOCAL __thread
+#endif
+
+// The free list and counters of one pool on one thread
+struct _PoolThread {
+    _PoolThread* next;
+    void* head;
+    // Negative on a thread that releases more objects than it allocates
+    std::ptrdiff_t live;
+    std::size_t free;
+};
+
+// The counters of one pool, in a list shared by all the modules
+// (the layout must match SFMLExt::PoolStats); `live` and `free` are the
+// sums over `threads`, updated by `_pool_update`
+struct _PoolStats {
+    _PoolStats* next;
+    const char* name;
+    std::size_t live;
+    std::size_t free;
+    _PoolThread* threads;
+};
+
+inline _PoolStats*& _pool_list() {
+    static _PoolStats* head = 0;
+    return head;
+}
+
+// Guards the lists, which only grow the first time a type is used on a thread
+inline sf::Mutex& _pool_mutex() {
+    static sf::Mutex mutex;
+    return mutex;
+}
+
+template <typename T>
+class _Pool {
+    static _PoolStats stats;
+    static _POOL_THREAD_LOCAL _PoolThread* thread;
+
+    static _PoolThread& local() {
+        _PoolThread* t = thread;
+        if (!t) {
+            t = (_PoolThread*)calloc(1, sizeof(_PoolThread));
+            sf::Lock lock(_pool_mutex());
+            t->next = stats.threads;
+            stats.threads = t;
+            thread = t;
+        }
+        return *t;
+    }
+
+public:
+    static void* allocate(const char* name) {
+        if (!stats.name) {
+            sf::Lock lock(_pool_mutex());
+            if (!stats.name) {
+                stats.next = _pool_list();
+                stats.name = name;
+                _pool_list() = &stats;
+            }
+        }
+        _PoolThread& t = local();
+        ++t.live;
+        if (t.head) {
+            void* block = t.head;
+            t.head = *(void**)block;
+            --t.free;
+            return block;
+        }
+        return malloc(sizeof(T) < sizeof(void*) ? sizeof(void*) : sizeof(T));
+    }
+
+    static void release(void* block) {
+        _PoolThread& t = local();
+        --t.live;
+        if (t.free >= _POOL_MAX_FREE) {
+            free(block);
+            return;
+        }
+        *(void**)block = t.head;
+        t.head = block;
+        ++t.free;
+    }
+};
+
+template <typename T>
+_PoolStats _Pool<T>::stats = {0, 0, 0, 0, 0};
+template <typename T>
+_POOL_THREAD_LOCAL _PoolThread* _Pool<T>::thread = 0;
+
+// Add up the counters of all the threads, and return the first pool.
+// Counts of other threads that are allocating at the same time may be
+// slightly out of date.
+inline _PoolStats* _pool_update() {
+    sf::Lock lock(_pool_mutex());
+    for (_PoolStats* stats = _pool_list(); stats; stats = stats->next) {
+        std::ptrdiff_t live = 0;
+        std::size_t free = 0;
+        for (_PoolThread* t = stats->threads; t; t = t->next) {
+            live += t->live;
+            free += t->free;
+        }
+        stats->live = live > 0 ? (std::size_t)live : 0;
+        stats->free = free;
+    }
+    return _pool_list();
+}
+
+#endif
@@ -2,285 +2,374 @@
 using namespace sf;
 #include <vector>
 typedef std::vector<Uint8> MemoryBuffer;
+#include "../instrument.hpp"
+#include "../pool.hpp"
+#include "../value_structs.hpp"
 extern "C" {
+#ifdef CRSFML_INSTRUMENT
+_Probe* sfml_probes_first() {
+    return _Probe::list().load();
+}
+void sfml_probes_reset() {
+    for (_Probe* probe = _Probe::list().load(); probe; probe = probe->next) {
+        probe->calls = 0;
+        probe->ticks = 0;
+    }
+}
+#endif
+_PoolStats* sfml_pools_first() {
+    return _pool_update();
+}
 void sfml_time_allocate(void** result) {
-    *result = malloc(sizeof(Time));
+    CRSFML_PROBE();
+    *result = _Pool<Time>::allocate("Time");
 }
 void sfml_time_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Time>::release(self);
 }
 void sfml_time_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Time();
 }
 void sfml_time_asseconds(void* self, float* result) {
+    CRSFML_PROBE();
     *(float*)result = ((Time*)self)->asSeconds();
 }
 void sfml_time_asmilliseconds(void* self, Int32* result) {
+    CRSFML_PROBE();
     *(Int32*)result = ((Time*)self)->asMilliseconds();
 }
 void sfml_time_asmicroseconds(void* self, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((Time*)self)->asMicroseconds();
 }
-void sfml_operator_eq_f4Tf4T(void* left, void* right, Int8* result) {
-    *(bool*)result = operator==(*(Time*)left, *(Time*)right);
+void sfml_operator_eq_f4Tf4T(_CTime left, _CTime right, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = operator==(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_ne_f4Tf4T(void* left, void* right, Int8* result) {
-    *(bool*)result = operator!=(*(Time*)left, *(Time*)right);
+void sfml_operator_ne_f4Tf4T(_CTime left, _CTime right, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = operator!=(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_lt_f4Tf4T(void* left, void* right, Int8* result) {
-    *(bool*)result = operator<(*(Time*)left, *(Time*)right);
+void sfml_operator_lt_f4Tf4T(_CTime left, _CTime right, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = operator<(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_gt_f4Tf4T(void* left, void* right, Int8* result) {
-    *(bool*)result = operator>(*(Time*)left, *(Time*)right);
+void sfml_operator_gt_f4Tf4T(_CTime left, _CTime right, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = operator>(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_le_f4Tf4T(void* left, void* right, Int8* result) {
-    *(bool*)result = operator<=(*(Time*)left, *(Time*)right);
+void sfml_operator_le_f4Tf4T(_CTime left, _CTime right, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = operator<=(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_ge_f4Tf4T(void* left, void* right, Int8* result) {
-    *(bool*)result = operator>=(*(Time*)left, *(Time*)right);
+void sfml_operator_ge_f4Tf4T(_CTime left, _CTime right, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = operator>=(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_sub_f4T(void* right, void* result) {
-    *(Time*)result = operator-(*(Time*)right);
+_CTime sfml_operator_sub_f4T(_CTime right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator-(_from_c<Time>(right)));
 }
-void sfml_operator_add_f4Tf4T(void* left, void* right, void* result) {
-    *(Time*)result = operator+(*(Time*)left, *(Time*)right);
+_CTime sfml_operator_add_f4Tf4T(_CTime left, _CTime right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator+(_from_c<Time>(left), _from_c<Time>(right)));
 }
-void sfml_operator_sub_f4Tf4T(void* left, void* right, void* result) {
-    *(Time*)result = operator-(*(Time*)left, *(Time*)right);
+_CTime sfml_operator_sub_f4Tf4T(_CTime left, _CTime right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator-(_from_c<Time>(left), _from_c<Time>(right)));
 }
-void sfml_operator_mul_f4TBw9(void* left, float right, void* result) {
-    *(Time*)result = operator*(*(Time*)left, right);
+_CTime sfml_operator_mul_f4TBw9(_CTime left, float right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator*(_from_c<Time>(left), right));
 }
-void sfml_operator_mul_f4TG4x(void* left, Int64 right, void* result) {
-    *(Time*)result = operator*(*(Time*)left, right);
+_CTime sfml_operator_mul_f4TG4x(_CTime left, Int64 right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator*(_from_c<Time>(left), right));
 }
-void sfml_operator_div_f4TBw9(void* left, float right, void* result) {
-    *(Time*)result = operator/(*(Time*)left, right);
+_CTime sfml_operator_div_f4TBw9(_CTime left, float right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator/(_from_c<Time>(left), right));
 }
-void sfml_operator_div_f4TG4x(void* left, Int64 right, void* result) {
-    *(Time*)result = operator/(*(Time*)left, right);
+_CTime sfml_operator_div_f4TG4x(_CTime left, Int64 right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator/(_from_c<Time>(left), right));
 }
-void sfml_operator_div_f4Tf4T(void* left, void* right, float* result) {
-    *(float*)result = operator/(*(Time*)left, *(Time*)right);
+void sfml_operator_div_f4Tf4T(_CTime left, _CTime right, float* result) {
+    CRSFML_PROBE();
+    *(float*)result = operator/(_from_c<Time>(left), _from_c<Time>(right));
 }
-void sfml_operator_mod_f4Tf4T(void* left, void* right, void* result) {
-    *(Time*)result = operator%(*(Time*)left, *(Time*)right);
+_CTime sfml_operator_mod_f4Tf4T(_CTime left, _CTime right) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(operator%(_from_c<Time>(left), _from_c<Time>(right)));
 }
-void sfml_time_initialize_PxG(void* self, void* copy) {
-    new(self) Time(*(Time*)copy);
+void sfml_time_initialize_PxG(void* self, _CTime copy) {
+    CRSFML_PROBE();
+    new(self) Time(_from_c<Time>(copy));
 }
-void sfml_seconds_Bw9(float amount, void* result) {
-    *(Time*)result = seconds(amount);
+_CTime sfml_seconds_Bw9(float amount) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(seconds(amount));
 }
-void sfml_milliseconds_qe2(Int32 amount, void* result) {
-    *(Time*)result = milliseconds(amount);
+_CTime sfml_milliseconds_qe2(Int32 amount) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(milliseconds(amount));
 }
-void sfml_microseconds_G4x(Int64 amount, void* result) {
-    *(Time*)result = microseconds(amount);
+_CTime sfml_microseconds_G4x(Int64 amount) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(microseconds(amount));
 }
 void sfml_clock_allocate(void** result) {
-    *result = malloc(sizeof(Clock));
+    CRSFML_PROBE();
+    *result = _Pool<Clock>::allocate("Clock");
 }
 void sfml_clock_finalize(void* self) {
+    CRSFML_PROBE();
     ((Clock*)self)->~Clock();
 }
 void sfml_clock_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Clock>::release(self);
 }
 void sfml_clock_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Clock();
 }
-void sfml_clock_getelapsedtime(void* self, void* result) {
-    *(Time*)result = ((Clock*)self)->getElapsedTime();
+_CTime sfml_clock_getelapsedtime(void* self) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(((Clock*)self)->getElapsedTime());
 }
-void sfml_clock_restart(void* self, void* result) {
-    *(Time*)result = ((Clock*)self)->restart();
+_CTime sfml_clock_restart(void* self) {
+    CRSFML_PROBE();
+    return _to_c<_CTime>(((Clock*)self)->restart());
 }
 void sfml_clock_initialize_LuC(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Clock(*(Clock*)copy);
 }
-void (*_sfml_inputstream_read_callback)(void*, void*, Int64, Int64*) = 0;
-void sfml_inputstream_read_callback(void (*callback)(void*, void*, Int64, Int64*)) {
-    _sfml_inputstream_read_callback = callback;
-}
-void (*_sfml_inputstream_seek_callback)(void*, Int64, Int64*) = 0;
-void sfml_inputstream_seek_callback(void (*callback)(void*, Int64, Int64*)) {
-    _sfml_inputstream_seek_callback = callback;
-}
-void (*_sfml_inputstream_tell_callback)(void*, Int64*) = 0;
-void sfml_inputstream_tell_callback(void (*callback)(void*, Int64*)) {
-    _sfml_inputstream_tell_callback = callback;
-}
-void (*_sfml_inputstream_getsize_callback)(void*, Int64*) = 0;
-void sfml_inputstream_getsize_callback(void (*callback)(void*, Int64*)) {
-    _sfml_inputstream_getsize_callback = callback;
-}
+struct _InputStreamVtable {
+    void (*read)(void*, void*, Int64, Int64*);
+    void (*seek)(void*, Int64, Int64*);
+    void (*tell)(void*, Int64*);
+    void (*getSize)(void*, Int64*);
+};
 class _InputStream : public sf::InputStream {
 public:
     void* parent;
+    const _InputStreamVtable* vtable;
     virtual Int64 read(void* data, Int64 size) {
         Int64 result;
-        _sfml_inputstream_read_callback(parent, (void*)data, (Int64)size, (Int64*)&result);
+        vtable->read(parent, (void*)data, (Int64)size, (Int64*)&result);
         return result;
     }
     virtual Int64 seek(Int64 position) {
         Int64 result;
-        _sfml_inputstream_seek_callback(parent, (Int64)position, (Int64*)&result);
+        vtable->seek(parent, (Int64)position, (Int64*)&result);
         return result;
     }
     virtual Int64 tell() {
         Int64 result;
-        _sfml_inputstream_tell_callback(parent, (Int64*)&result);
+        vtable->tell(parent, (Int64*)&result);
         return result;
     }
     virtual Int64 getSize() {
         Int64 result;
-        _sfml_inputstream_getsize_callback(parent, (Int64*)&result);
+        vtable->getSize(parent, (Int64*)&result);
         return result;
     }
 };
-void sfml_inputstream_parent(void* self, void* parent) {
+void sfml_inputstream_parent(void* self, void* parent, void* vtable) {
+    CRSFML_PROBE();
     ((_InputStream*)self)->parent = parent;
+    ((_InputStream*)self)->vtable = (const _InputStreamVtable*)vtable;
 }
 void sfml_inputstream_allocate(void** result) {
-    *result = malloc(sizeof(_InputStream));
+    CRSFML_PROBE();
+    *result = _Pool<_InputStream>::allocate("_InputStream");
 }
 void sfml_inputstream_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) _InputStream();
 }
 void sfml_inputstream_finalize(void* self) {
+    CRSFML_PROBE();
     ((_InputStream*)self)->~_InputStream();
 }
 void sfml_inputstream_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<_InputStream>::release(self);
 }
 void sfml_noncopyable_allocate(void** result) {
-    *result = malloc(sizeof(NonCopyable));
+    CRSFML_PROBE();
+    *result = _Pool<NonCopyable>::allocate("NonCopyable");
 }
 void sfml_noncopyable_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<NonCopyable>::release(self);
 }
 void sfml_fileinputstream_allocate(void** result) {
-    *result = malloc(sizeof(FileInputStream));
+    CRSFML_PROBE();
+    *result = _Pool<FileInputStream>::allocate("FileInputStream");
 }
 void sfml_fileinputstream_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<FileInputStream>::release(self);
 }
 void sfml_fileinputstream_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) FileInputStream();
 }
 void sfml_fileinputstream_finalize(void* self) {
+    CRSFML_PROBE();
     ((FileInputStream*)self)->~FileInputStream();
 }
 void sfml_fileinputstream_open_zkC(void* self, std::size_t filename_size, char* filename, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((FileInputStream*)self)->open(std::string(filename, filename_size));
 }
 void sfml_fileinputstream_read_xALG4x(void* self, void* data, Int64 size, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((FileInputStream*)self)->read(data, size);
 }
 void sfml_fileinputstream_seek_G4x(void* self, Int64 position, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((FileInputStream*)self)->seek(position);
 }
 void sfml_fileinputstream_tell(void* self, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((FileInputStream*)self)->tell();
 }
 void sfml_fileinputstream_getsize(void* self, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((FileInputStream*)self)->getSize();
 }
 void sfml_memoryinputstream_allocate(void** result) {
-    *result = malloc(sizeof(MemoryInputStream));
+    CRSFML_PROBE();
+    *result = _Pool<MemoryInputStream>::allocate("MemoryInputStream");
 }
 void sfml_memoryinputstream_finalize(void* self) {
+    CRSFML_PROBE();
     ((MemoryInputStream*)self)->~MemoryInputStream();
 }
 void sfml_memoryinputstream_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<MemoryInputStream>::release(self);
 }
 void sfml_memoryinputstream_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) MemoryInputStream();
 }
 void sfml_memoryinputstream_open_5h8vgv(void* self, void* data, std::size_t size_in_bytes) {
+    CRSFML_PROBE();
     ((MemoryInputStream*)self)->open(data, size_in_bytes);
 }
 void sfml_memoryinputstream_read_xALG4x(void* self, void* data, Int64 size, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((MemoryInputStream*)self)->read(data, size);
 }
 void sfml_memoryinputstream_seek_G4x(void* self, Int64 position, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((MemoryInputStream*)self)->seek(position);
 }
 void sfml_memoryinputstream_tell(void* self, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((MemoryInputStream*)self)->tell();
 }
 void sfml_memoryinputstream_getsize(void* self, Int64* result) {
+    CRSFML_PROBE();
     *(Int64*)result = ((MemoryInputStream*)self)->getSize();
 }
 void sfml_memoryinputstream_initialize_kYd(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) MemoryInputStream(*(MemoryInputStream*)copy);
 }
 void sfml_mutex_allocate(void** result) {
-    *result = malloc(sizeof(Mutex));
+    CRSFML_PROBE();
+    *result = _Pool<Mutex>::allocate("Mutex");
 }
 void sfml_mutex_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Mutex>::release(self);
 }
 void sfml_mutex_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Mutex();
 }
 void sfml_mutex_finalize(void* self) {
+    CRSFML_PROBE();
     ((Mutex*)self)->~Mutex();
 }
 void sfml_mutex_lock(void* self) {
+    CRSFML_PROBE();
     ((Mutex*)self)->lock();
 }
 void sfml_mutex_unlock(void* self) {
+    CRSFML_PROBE();
     ((Mutex*)self)->unlock();
 }
-void sfml_sleep_f4T(void* duration) {
-    sleep(*(Time*)duration);
+void sfml_sleep_f4T(_CTime duration) {
+    CRSFML_PROBE();
+    sleep(_from_c<Time>(duration));
 }
 void sfml_thread_allocate(void** result) {
-    *result = malloc(sizeof(Thread));
+    CRSFML_PROBE();
+    *result = _Pool<Thread>::allocate("Thread");
 }
 void sfml_thread_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Thread>::release(self);
 }
 void sfml_thread_initialize_XPcbdx(void* self, void (*function)(void*), void* argument) {
+    CRSFML_PROBE();
     new(self) Thread(function, argument);
 }
 void sfml_thread_finalize(void* self) {
+    CRSFML_PROBE();
     ((Thread*)self)->~Thread();
 }
 void sfml_thread_launch(void* self) {
+    CRSFML_PROBE();
     ((Thread*)self)->launch();
 }
 void sfml_thread_wait(void* self) {
+    CRSFML_PROBE();
     ((Thread*)self)->wait();
 }
 void sfml_thread_terminate(void* self) {
+    CRSFML_PROBE();
     ((Thread*)self)->terminate();
 }
 void sfml_memorybuffer_allocate(void** result) {
-    *result = malloc(sizeof(MemoryBuffer));
+    CRSFML_PROBE();
+    *result = _Pool<MemoryBuffer>::allocate("MemoryBuffer");
 }
 void sfml_memorybuffer_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) MemoryBuffer();
 }
 void sfml_memorybuffer_finalize(void* self) {
+    CRSFML_PROBE();
     ((MemoryBuffer*)self)->~MemoryBuffer();
 }
 void sfml_memorybuffer_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<MemoryBuffer>::release(self);
 }
 void sfml_memorybuffer_data(void* self, Uint8** result) {
+    CRSFML_PROBE();
     *(Uint8**)result = ((MemoryBuffer*)self)->data();
 }
 void sfml_memorybuffer_size(void* self, std::size_t* result) {
+    CRSFML_PROBE();
     *(std::size_t*)result = ((MemoryBuffer*)self)->size();
 }
 void sfml_memorybuffer_clear(void* self) {
+    CRSFML_PROBE();
     ((MemoryBuffer*)self)->clear();
 }
 void sfml_memorybuffer_initialize_FlS(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) MemoryBuffer(*(MemoryBuffer*)copy);
 }
 void sfml_system_version(int* major, int* minor, int* patch) {
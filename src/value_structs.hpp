@@ -0,0 +1,45 @@
+// Plain C counterparts of the small SFML structs that ext.cpp passes and
+// returns by value (VALUE_STRUCTS in generate.cr).
+//
+// sf::Time, sf::Vector2f and the others have constructors, so they aren't
+// C types: returning them from an `extern "C"` function is a warning on
+// Clang, and on MSVC x64 they are returned through a hidden pointer where
+// Crystal expects the value in registers. These structs have the same
+// layout (which must also match the lib structs in SFMLExt), and the
+// values are converted at the boundary.
+
+#ifndef CRSFML_VALUE_STRUCTS_HPP
+#define CRSFML_VALUE_STRUCTS_HPP
+
+#include <cstring>
+
+struct _CTime { long long microseconds; };
+struct _CVector2f { float x, y; };
+struct _CVector2i { int x, y; };
+struct _CVector2u { unsigned int x, y; };
+struct _CVector3f { float x, y, z; };
+struct _CColor { unsigned char r, g, b, a; };
+struct _CFloatRect { float left, top, width, height; };
+struct _CIntRect { int left, top, width, height; };
+
+// Copy an SFML value into its C struct
+template <typename C, typename T>
+inline C _to_c(const T& value) {
+    typedef char same_size[sizeof(C) == sizeof(T) ? 1 : -1];
+    (void)sizeof(same_size);
+    C result;
+    std::memcpy(&result, &value, sizeof(C));
+    return result;
+}
+
+// Copy a C struct into the SFML value
+template <typename T, typename C>
+inline T _from_c(const C& value) {
+    typedef char same_size[sizeof(C) == sizeof(T) ? 1 : -1];
+    (void)sizeof(same_size);
+    T result;
+    std::memcpy(&result, &value, sizeof(T));
+    return result;
+}
+
+#endif
@@ -3,572 +3,761 @@
 using namespace sf;
 #include <vector>
 typedef std::vector<Uint8> MemoryBuffer;
+#include "../instrument.hpp"
+#include "../pool.hpp"
+#include "../value_structs.hpp"
 extern "C" {
 void sfml_clipboard_allocate(void** result) {
-    *result = malloc(sizeof(Clipboard));
+    CRSFML_PROBE();
+    *result = _Pool<Clipboard>::allocate("Clipboard");
 }
 void sfml_clipboard_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Clipboard>::release(self);
 }
 void sfml_clipboard_getstring(Uint32** result) {
+    CRSFML_PROBE();
     static String str;
     str = Clipboard::getString();
     *result = const_cast<Uint32*>(str.getData());
 }
 void sfml_clipboard_setstring_bQs(std::size_t text_size, Uint32* text) {
+    CRSFML_PROBE();
     Clipboard::setString(String::fromUtf32(text, text+text_size));
 }
 void sfml_glresource_allocate(void** result) {
-    *result = malloc(sizeof(GlResource));
+    CRSFML_PROBE();
+    *result = _Pool<GlResource>::allocate("GlResource");
 }
 void sfml_glresource_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<GlResource>::release(self);
 }
 void sfml_contextsettings_allocate(void** result) {
-    *result = malloc(sizeof(ContextSettings));
+    CRSFML_PROBE();
+    *result = _Pool<ContextSettings>::allocate("ContextSettings");
 }
 void sfml_contextsettings_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<ContextSettings>::release(self);
 }
 void sfml_contextsettings_initialize_emSemSemSemSemSemSGZq(void* self, unsigned int depth, unsigned int stencil, unsigned int antialiasing, unsigned int major, unsigned int minor, unsigned int attributes, Int8 s_rgb) {
+    CRSFML_PROBE();
     new(self) ContextSettings(depth, stencil, antialiasing, major, minor, attributes, s_rgb != 0);
 }
 void sfml_contextsettings_setdepthbits_emS(void* self, unsigned int depth_bits) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->depthBits = depth_bits;
 }
 void sfml_contextsettings_setstencilbits_emS(void* self, unsigned int stencil_bits) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->stencilBits = stencil_bits;
 }
 void sfml_contextsettings_setantialiasinglevel_emS(void* self, unsigned int antialiasing_level) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->antialiasingLevel = antialiasing_level;
 }
 void sfml_contextsettings_setmajorversion_emS(void* self, unsigned int major_version) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->majorVersion = major_version;
 }
 void sfml_contextsettings_setminorversion_emS(void* self, unsigned int minor_version) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->minorVersion = minor_version;
 }
 void sfml_contextsettings_setattributeflags_saL(void* self, Uint32 attribute_flags) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->attributeFlags = attribute_flags;
 }
 void sfml_contextsettings_setsrgbcapable_GZq(void* self, Int8 s_rgb_capable) {
+    CRSFML_PROBE();
     ((ContextSettings*)self)->sRgbCapable = s_rgb_capable != 0;
 }
 void sfml_contextsettings_initialize_Fw4(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) ContextSettings(*(ContextSettings*)copy);
 }
 void sfml_context_allocate(void** result) {
-    *result = malloc(sizeof(Context));
+    CRSFML_PROBE();
+    *result = _Pool<Context>::allocate("Context");
 }
 void sfml_context_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Context>::release(self);
 }
 void sfml_context_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Context();
 }
 void sfml_context_finalize(void* self) {
+    CRSFML_PROBE();
     ((Context*)self)->~Context();
 }
 void sfml_context_setactive_GZq(void* self, Int8 active, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Context*)self)->setActive(active != 0);
 }
 void sfml_context_getsettings(void* self, void* result) {
+    CRSFML_PROBE();
     *(ContextSettings*)result = ((Context*)self)->getSettings();
 }
 void sfml_context_isextensionavailable_Yy6(char* name, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Context::isExtensionAvailable(name);
 }
 void sfml_context_getactivecontext(void** result) {
+    CRSFML_PROBE();
     *(Context**)result = const_cast<Context*>(Context::getActiveContext());
 }
 void sfml_context_getactivecontextid(Uint64* result) {
+    CRSFML_PROBE();
     *(Uint64*)result = Context::getActiveContextId();
 }
 void sfml_context_initialize_Fw4emSemS(void* self, void* settings, unsigned int width, unsigned int height) {
+    CRSFML_PROBE();
     new(self) Context(*(ContextSettings*)settings, width, height);
 }
 void sfml_cursor_allocate(void** result) {
-    *result = malloc(sizeof(Cursor));
+    CRSFML_PROBE();
+    *result = _Pool<Cursor>::allocate("Cursor");
 }
 void sfml_cursor_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Cursor>::release(self);
 }
 void sfml_cursor_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Cursor();
 }
 void sfml_cursor_finalize(void* self) {
+    CRSFML_PROBE();
     ((Cursor*)self)->~Cursor();
 }
-void sfml_cursor_loadfrompixels_843t9zt9z(void* self, Uint8* pixels, void* size, void* hotspot, Int8* result) {
-    *(bool*)result = ((Cursor*)self)->loadFromPixels(pixels, *(Vector2u*)size, *(Vector2u*)hotspot);
+void sfml_cursor_loadfrompixels_843t9zt9z(void* self, Uint8* pixels, _CVector2u size, _CVector2u hotspot, Int8* result) {
+    CRSFML_PROBE();
+    *(bool*)result = ((Cursor*)self)->loadFromPixels(pixels, _from_c<Vector2u>(size), _from_c<Vector2u>(hotspot));
 }
 void sfml_cursor_loadfromsystem_yAZ(void* self, int type, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Cursor*)self)->loadFromSystem((Cursor::Type)type);
 }
 void sfml_joystick_allocate(void** result) {
-    *result = malloc(sizeof(Joystick));
+    CRSFML_PROBE();
+    *result = _Pool<Joystick>::allocate("Joystick");
 }
 void sfml_joystick_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Joystick>::release(self);
 }
 void sfml_joystick_identification_allocate(void** result) {
-    *result = malloc(sizeof(Joystick::Identification));
+    CRSFML_PROBE();
+    *result = _Pool<Joystick::Identification>::allocate("Joystick::Identification");
 }
 void sfml_joystick_identification_finalize(void* self) {
+    CRSFML_PROBE();
     ((Joystick::Identification*)self)->~Identification();
 }
 void sfml_joystick_identification_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Joystick::Identification>::release(self);
 }
 void sfml_joystick_identification_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Joystick::Identification();
 }
 void sfml_joystick_identification_getname(void* self, Uint32** result) {
+    CRSFML_PROBE();
     static String str;
     str = ((Joystick::Identification*)self)->name;
     *result = const_cast<Uint32*>(str.getData());
 }
 void sfml_joystick_identification_setname_Lnu(void* self, std::size_t name_size, Uint32* name) {
+    CRSFML_PROBE();
     ((Joystick::Identification*)self)->name = String::fromUtf32(name, name+name_size);
 }
 void sfml_joystick_identification_getvendorid(void* self, unsigned int* result) {
+    CRSFML_PROBE();
     *(unsigned int*)result = ((Joystick::Identification*)self)->vendorId;
 }
 void sfml_joystick_identification_setvendorid_emS(void* self, unsigned int vendor_id) {
+    CRSFML_PROBE();
     ((Joystick::Identification*)self)->vendorId = vendor_id;
 }
 void sfml_joystick_identification_getproductid(void* self, unsigned int* result) {
+    CRSFML_PROBE();
     *(unsigned int*)result = ((Joystick::Identification*)self)->productId;
 }
 void sfml_joystick_identification_setproductid_emS(void* self, unsigned int product_id) {
+    CRSFML_PROBE();
     ((Joystick::Identification*)self)->productId = product_id;
 }
 void sfml_joystick_identification_initialize_ISj(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Joystick::Identification(*(Joystick::Identification*)copy);
 }
 void sfml_joystick_isconnected_emS(unsigned int joystick, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Joystick::isConnected(joystick);
 }
 void sfml_joystick_getbuttoncount_emS(unsigned int joystick, unsigned int* result) {
+    CRSFML_PROBE();
     *(unsigned int*)result = Joystick::getButtonCount(joystick);
 }
 void sfml_joystick_hasaxis_emSHdj(unsigned int joystick, int axis, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Joystick::hasAxis(joystick, (Joystick::Axis)axis);
 }
 void sfml_joystick_isbuttonpressed_emSemS(unsigned int joystick, unsigned int button, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Joystick::isButtonPressed(joystick, button);
 }
 void sfml_joystick_getaxisposition_emSHdj(unsigned int joystick, int axis, float* result) {
+    CRSFML_PROBE();
     *(float*)result = Joystick::getAxisPosition(joystick, (Joystick::Axis)axis);
 }
 void sfml_joystick_getidentification_emS(unsigned int joystick, void* result) {
+    CRSFML_PROBE();
     *(Joystick::Identification*)result = Joystick::getIdentification(joystick);
 }
 void sfml_joystick_update() {
+    CRSFML_PROBE();
     Joystick::update();
 }
 void sfml_keyboard_allocate(void** result) {
-    *result = malloc(sizeof(Keyboard));
+    CRSFML_PROBE();
+    *result = _Pool<Keyboard>::allocate("Keyboard");
 }
 void sfml_keyboard_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Keyboard>::release(self);
 }
 void sfml_keyboard_scan_allocate(void** result) {
-    *result = malloc(sizeof(Keyboard::Scan));
+    CRSFML_PROBE();
+    *result = _Pool<Keyboard::Scan>::allocate("Keyboard::Scan");
 }
 void sfml_keyboard_scan_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Keyboard::Scan>::release(self);
 }
 void sfml_keyboard_iskeypressed_cKW(int key, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Keyboard::isKeyPressed((Keyboard::Key)key);
 }
 void sfml_keyboard_iskeypressed_1Us(int code, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Keyboard::isKeyPressed((Keyboard::Scan::Scancode)code);
 }
 void sfml_keyboard_localize_1Us(int code, int* result) {
+    CRSFML_PROBE();
     *(Keyboard::Key*)result = Keyboard::localize((Keyboard::Scan::Scancode)code);
 }
 void sfml_keyboard_delocalize_cKW(int key, int* result) {
+    CRSFML_PROBE();
     *(Keyboard::Scan::Scancode*)result = Keyboard::delocalize((Keyboard::Key)key);
 }
 void sfml_keyboard_getdescription_1Us(int code, Uint32** result) {
+    CRSFML_PROBE();
     static String str;
     str = Keyboard::getDescription((Keyboard::Scan::Scancode)code);
     *result = const_cast<Uint32*>(str.getData());
 }
 void sfml_keyboard_setvirtualkeyboardvisible_GZq(Int8 visible) {
+    CRSFML_PROBE();
     Keyboard::setVirtualKeyboardVisible(visible != 0);
 }
 void sfml_mouse_allocate(void** result) {
-    *result = malloc(sizeof(Mouse));
+    CRSFML_PROBE();
+    *result = _Pool<Mouse>::allocate("Mouse");
 }
 void sfml_mouse_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Mouse>::release(self);
 }
 void sfml_mouse_isbuttonpressed_Zxg(int button, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Mouse::isButtonPressed((Mouse::Button)button);
 }
-void sfml_mouse_getposition(void* result) {
-    *(Vector2i*)result = Mouse::getPosition();
+_CVector2i sfml_mouse_getposition() {
+    CRSFML_PROBE();
+    return _to_c<_CVector2i>(Mouse::getPosition());
 }
-void sfml_mouse_getposition_occ(void* relative_to, void* result) {
-    *(Vector2i*)result = Mouse::getPosition(*(WindowBase*)relative_to);
+_CVector2i sfml_mouse_getposition_occ(void* relative_to) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2i>(Mouse::getPosition(*(WindowBase*)relative_to));
 }
-void sfml_mouse_setposition_ufV(void* position) {
-    Mouse::setPosition(*(Vector2i*)position);
+void sfml_mouse_setposition_ufV(_CVector2i position) {
+    CRSFML_PROBE();
+    Mouse::setPosition(_from_c<Vector2i>(position));
 }
-void sfml_mouse_setposition_ufVocc(void* position, void* relative_to) {
-    Mouse::setPosition(*(Vector2i*)position, *(WindowBase*)relative_to);
+void sfml_mouse_setposition_ufVocc(_CVector2i position, void* relative_to) {
+    CRSFML_PROBE();
+    Mouse::setPosition(_from_c<Vector2i>(position), *(WindowBase*)relative_to);
 }
 void sfml_sensor_allocate(void** result) {
-    *result = malloc(sizeof(Sensor));
+    CRSFML_PROBE();
+    *result = _Pool<Sensor>::allocate("Sensor");
 }
 void sfml_sensor_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Sensor>::release(self);
 }
 void sfml_sensor_isavailable_jRE(int sensor, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Sensor::isAvailable((Sensor::Type)sensor);
 }
 void sfml_sensor_setenabled_jREGZq(int sensor, Int8 enabled) {
+    CRSFML_PROBE();
     Sensor::setEnabled((Sensor::Type)sensor, enabled != 0);
 }
-void sfml_sensor_getvalue_jRE(int sensor, void* result) {
-    *(Vector3f*)result = Sensor::getValue((Sensor::Type)sensor);
+_CVector3f sfml_sensor_getvalue_jRE(int sensor) {
+    CRSFML_PROBE();
+    return _to_c<_CVector3f>(Sensor::getValue((Sensor::Type)sensor));
 }
 void sfml_event_allocate(void** result) {
-    *result = malloc(sizeof(Event));
+    CRSFML_PROBE();
+    *result = _Pool<Event>::allocate("Event");
 }
 void sfml_event_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event>::release(self);
 }
 void sfml_event_sizeevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::SizeEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::SizeEvent>::allocate("Event::SizeEvent");
 }
 void sfml_event_sizeevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::SizeEvent();
 }
 void sfml_event_sizeevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::SizeEvent>::release(self);
 }
 void sfml_event_sizeevent_setwidth_emS(void* self, unsigned int width) {
+    CRSFML_PROBE();
     ((Event::SizeEvent*)self)->width = width;
 }
 void sfml_event_sizeevent_setheight_emS(void* self, unsigned int height) {
+    CRSFML_PROBE();
     ((Event::SizeEvent*)self)->height = height;
 }
 void sfml_event_sizeevent_initialize_isq(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::SizeEvent(*(Event::SizeEvent*)copy);
 }
 void sfml_event_keyevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::KeyEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::KeyEvent>::allocate("Event::KeyEvent");
 }
 void sfml_event_keyevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::KeyEvent();
 }
 void sfml_event_keyevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::KeyEvent>::release(self);
 }
 void sfml_event_keyevent_setcode_cKW(void* self, int code) {
+    CRSFML_PROBE();
     ((Event::KeyEvent*)self)->code = (Keyboard::Key)code;
 }
 void sfml_event_keyevent_setscancode_1Us(void* self, int scancode) {
+    CRSFML_PROBE();
     ((Event::KeyEvent*)self)->scancode = (Keyboard::Scan::Scancode)scancode;
 }
 void sfml_event_keyevent_setalt_GZq(void* self, Int8 alt) {
+    CRSFML_PROBE();
     ((Event::KeyEvent*)self)->alt = alt != 0;
 }
 void sfml_event_keyevent_setcontrol_GZq(void* self, Int8 control) {
+    CRSFML_PROBE();
     ((Event::KeyEvent*)self)->control = control != 0;
 }
 void sfml_event_keyevent_setshift_GZq(void* self, Int8 shift) {
+    CRSFML_PROBE();
     ((Event::KeyEvent*)self)->shift = shift != 0;
 }
 void sfml_event_keyevent_setsystem_GZq(void* self, Int8 system) {
+    CRSFML_PROBE();
     ((Event::KeyEvent*)self)->system = system != 0;
 }
 void sfml_event_keyevent_initialize_wJ8(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::KeyEvent(*(Event::KeyEvent*)copy);
 }
 void sfml_event_textevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::TextEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::TextEvent>::allocate("Event::TextEvent");
 }
 void sfml_event_textevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::TextEvent();
 }
 void sfml_event_textevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::TextEvent>::release(self);
 }
 void sfml_event_textevent_setunicode_saL(void* self, Uint32 unicode) {
+    CRSFML_PROBE();
     ((Event::TextEvent*)self)->unicode = unicode;
 }
 void sfml_event_textevent_initialize_uku(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::TextEvent(*(Event::TextEvent*)copy);
 }
 void sfml_event_mousemoveevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::MouseMoveEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::MouseMoveEvent>::allocate("Event::MouseMoveEvent");
 }
 void sfml_event_mousemoveevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::MouseMoveEvent();
 }
 void sfml_event_mousemoveevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::MouseMoveEvent>::release(self);
 }
 void sfml_event_mousemoveevent_setx_2mh(void* self, int x) {
+    CRSFML_PROBE();
     ((Event::MouseMoveEvent*)self)->x = x;
 }
 void sfml_event_mousemoveevent_sety_2mh(void* self, int y) {
+    CRSFML_PROBE();
     ((Event::MouseMoveEvent*)self)->y = y;
 }
 void sfml_event_mousemoveevent_initialize_1i3(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::MouseMoveEvent(*(Event::MouseMoveEvent*)copy);
 }
 void sfml_event_mousebuttonevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::MouseButtonEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::MouseButtonEvent>::allocate("Event::MouseButtonEvent");
 }
 void sfml_event_mousebuttonevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::MouseButtonEvent();
 }
 void sfml_event_mousebuttonevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::MouseButtonEvent>::release(self);
 }
 void sfml_event_mousebuttonevent_setbutton_Zxg(void* self, int button) {
+    CRSFML_PROBE();
     ((Event::MouseButtonEvent*)self)->button = (Mouse::Button)button;
 }
 void sfml_event_mousebuttonevent_setx_2mh(void* self, int x) {
+    CRSFML_PROBE();
     ((Event::MouseButtonEvent*)self)->x = x;
 }
 void sfml_event_mousebuttonevent_sety_2mh(void* self, int y) {
+    CRSFML_PROBE();
     ((Event::MouseButtonEvent*)self)->y = y;
 }
 void sfml_event_mousebuttonevent_initialize_Tjo(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::MouseButtonEvent(*(Event::MouseButtonEvent*)copy);
 }
 void sfml_event_mousewheelevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::MouseWheelEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::MouseWheelEvent>::allocate("Event::MouseWheelEvent");
 }
 void sfml_event_mousewheelevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::MouseWheelEvent();
 }
 void sfml_event_mousewheelevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::MouseWheelEvent>::release(self);
 }
 void sfml_event_mousewheelevent_setdelta_2mh(void* self, int delta) {
+    CRSFML_PROBE();
     ((Event::MouseWheelEvent*)self)->delta = delta;
 }
 void sfml_event_mousewheelevent_setx_2mh(void* self, int x) {
+    CRSFML_PROBE();
     ((Event::MouseWheelEvent*)self)->x = x;
 }
 void sfml_event_mousewheelevent_sety_2mh(void* self, int y) {
+    CRSFML_PROBE();
     ((Event::MouseWheelEvent*)self)->y = y;
 }
 void sfml_event_mousewheelevent_initialize_Wk7(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::MouseWheelEvent(*(Event::MouseWheelEvent*)copy);
 }
 void sfml_event_mousewheelscrollevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::MouseWheelScrollEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::MouseWheelScrollEvent>::allocate("Event::MouseWheelScrollEvent");
 }
 void sfml_event_mousewheelscrollevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::MouseWheelScrollEvent();
 }
 void sfml_event_mousewheelscrollevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::MouseWheelScrollEvent>::release(self);
 }
 void sfml_event_mousewheelscrollevent_setwheel_yiC(void* self, int wheel) {
+    CRSFML_PROBE();
     ((Event::MouseWheelScrollEvent*)self)->wheel = (Mouse::Wheel)wheel;
 }
 void sfml_event_mousewheelscrollevent_setdelta_Bw9(void* self, float delta) {
+    CRSFML_PROBE();
     ((Event::MouseWheelScrollEvent*)self)->delta = delta;
 }
 void sfml_event_mousewheelscrollevent_setx_2mh(void* self, int x) {
+    CRSFML_PROBE();
     ((Event::MouseWheelScrollEvent*)self)->x = x;
 }
 void sfml_event_mousewheelscrollevent_sety_2mh(void* self, int y) {
+    CRSFML_PROBE();
     ((Event::MouseWheelScrollEvent*)self)->y = y;
 }
 void sfml_event_mousewheelscrollevent_initialize_Am0(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::MouseWheelScrollEvent(*(Event::MouseWheelScrollEvent*)copy);
 }
 void sfml_event_joystickconnectevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::JoystickConnectEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::JoystickConnectEvent>::allocate("Event::JoystickConnectEvent");
 }
 void sfml_event_joystickconnectevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::JoystickConnectEvent();
 }
 void sfml_event_joystickconnectevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::JoystickConnectEvent>::release(self);
 }
 void sfml_event_joystickconnectevent_setjoystickid_emS(void* self, unsigned int joystick_id) {
+    CRSFML_PROBE();
     ((Event::JoystickConnectEvent*)self)->joystickId = joystick_id;
 }
 void sfml_event_joystickconnectevent_initialize_rYL(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::JoystickConnectEvent(*(Event::JoystickConnectEvent*)copy);
 }
 void sfml_event_joystickmoveevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::JoystickMoveEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::JoystickMoveEvent>::allocate("Event::JoystickMoveEvent");
 }
 void sfml_event_joystickmoveevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::JoystickMoveEvent();
 }
 void sfml_event_joystickmoveevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::JoystickMoveEvent>::release(self);
 }
 void sfml_event_joystickmoveevent_setjoystickid_emS(void* self, unsigned int joystick_id) {
+    CRSFML_PROBE();
     ((Event::JoystickMoveEvent*)self)->joystickId = joystick_id;
 }
 void sfml_event_joystickmoveevent_setaxis_Hdj(void* self, int axis) {
+    CRSFML_PROBE();
     ((Event::JoystickMoveEvent*)self)->axis = (Joystick::Axis)axis;
 }
 void sfml_event_joystickmoveevent_setposition_Bw9(void* self, float position) {
+    CRSFML_PROBE();
     ((Event::JoystickMoveEvent*)self)->position = position;
 }
 void sfml_event_joystickmoveevent_initialize_S8f(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::JoystickMoveEvent(*(Event::JoystickMoveEvent*)copy);
 }
 void sfml_event_joystickbuttonevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::JoystickButtonEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::JoystickButtonEvent>::allocate("Event::JoystickButtonEvent");
 }
 void sfml_event_joystickbuttonevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::JoystickButtonEvent();
 }
 void sfml_event_joystickbuttonevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::JoystickButtonEvent>::release(self);
 }
 void sfml_event_joystickbuttonevent_setjoystickid_emS(void* self, unsigned int joystick_id) {
+    CRSFML_PROBE();
     ((Event::JoystickButtonEvent*)self)->joystickId = joystick_id;
 }
 void sfml_event_joystickbuttonevent_setbutton_emS(void* self, unsigned int button) {
+    CRSFML_PROBE();
     ((Event::JoystickButtonEvent*)self)->button = button;
 }
 void sfml_event_joystickbuttonevent_initialize_V0a(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::JoystickButtonEvent(*(Event::JoystickButtonEvent*)copy);
 }
 void sfml_event_touchevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::TouchEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::TouchEvent>::allocate("Event::TouchEvent");
 }
 void sfml_event_touchevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::TouchEvent();
 }
 void sfml_event_touchevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::TouchEvent>::release(self);
 }
 void sfml_event_touchevent_setfinger_emS(void* self, unsigned int finger) {
+    CRSFML_PROBE();
     ((Event::TouchEvent*)self)->finger = finger;
 }
 void sfml_event_touchevent_setx_2mh(void* self, int x) {
+    CRSFML_PROBE();
     ((Event::TouchEvent*)self)->x = x;
 }
 void sfml_event_touchevent_sety_2mh(void* self, int y) {
+    CRSFML_PROBE();
     ((Event::TouchEvent*)self)->y = y;
 }
 void sfml_event_touchevent_initialize_1F1(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::TouchEvent(*(Event::TouchEvent*)copy);
 }
 void sfml_event_sensorevent_allocate(void** result) {
-    *result = malloc(sizeof(Event::SensorEvent));
+    CRSFML_PROBE();
+    *result = _Pool<Event::SensorEvent>::allocate("Event::SensorEvent");
 }
 void sfml_event_sensorevent_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Event::SensorEvent();
 }
 void sfml_event_sensorevent_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Event::SensorEvent>::release(self);
 }
 void sfml_event_sensorevent_settype_jRE(void* self, int type) {
+    CRSFML_PROBE();
     ((Event::SensorEvent*)self)->type = (Sensor::Type)type;
 }
 void sfml_event_sensorevent_setx_Bw9(void* self, float x) {
+    CRSFML_PROBE();
     ((Event::SensorEvent*)self)->x = x;
 }
 void sfml_event_sensorevent_sety_Bw9(void* self, float y) {
+    CRSFML_PROBE();
     ((Event::SensorEvent*)self)->y = y;
 }
 void sfml_event_sensorevent_setz_Bw9(void* self, float z) {
+    CRSFML_PROBE();
     ((Event::SensorEvent*)self)->z = z;
 }
 void sfml_event_sensorevent_initialize_0L9(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) Event::SensorEvent(*(Event::SensorEvent*)copy);
 }
 void sfml_touch_allocate(void** result) {
-    *result = malloc(sizeof(Touch));
+    CRSFML_PROBE();
+    *result = _Pool<Touch>::allocate("Touch");
 }
 void sfml_touch_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Touch>::release(self);
 }
 void sfml_touch_isdown_emS(unsigned int finger, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Touch::isDown(finger);
 }
-void sfml_touch_getposition_emS(unsigned int finger, void* result) {
-    *(Vector2i*)result = Touch::getPosition(finger);
+_CVector2i sfml_touch_getposition_emS(unsigned int finger) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2i>(Touch::getPosition(finger));
 }
-void sfml_touch_getposition_emSocc(unsigned int finger, void* relative_to, void* result) {
-    *(Vector2i*)result = Touch::getPosition(finger, *(WindowBase*)relative_to);
+_CVector2i sfml_touch_getposition_emSocc(unsigned int finger, void* relative_to) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2i>(Touch::getPosition(finger, *(WindowBase*)relative_to));
 }
 void sfml_videomode_allocate(void** result) {
-    *result = malloc(sizeof(VideoMode));
+    CRSFML_PROBE();
+    *result = _Pool<VideoMode>::allocate("VideoMode");
 }
 void sfml_videomode_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<VideoMode>::release(self);
 }
 void sfml_videomode_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) VideoMode();
 }
 void sfml_videomode_initialize_emSemSemS(void* self, unsigned int width, unsigned int height, unsigned int bits_per_pixel) {
+    CRSFML_PROBE();
     new(self) VideoMode(width, height, bits_per_pixel);
 }
 void sfml_videomode_getdesktopmode(void* result) {
+    CRSFML_PROBE();
     *(VideoMode*)result = VideoMode::getDesktopMode();
 }
 void sfml_videomode_getfullscreenmodes(void** result, std::size_t* result_size) {
+    CRSFML_PROBE();
     static std::vector<VideoMode> objs;
     objs = const_cast<std::vector<VideoMode>&>(VideoMode::getFullscreenModes());
     *result_size = objs.size();
     *result = &objs[0];
 }
 void sfml_videomode_isvalid(void* self, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((VideoMode*)self)->isValid();
 }
 void sfml_videomode_setwidth_emS(void* self, unsigned int width) {
+    CRSFML_PROBE();
     ((VideoMode*)self)->width = width;
 }
 void sfml_videomode_setheight_emS(void* self, unsigned int height) {
+    CRSFML_PROBE();
     ((VideoMode*)self)->height = height;
 }
 void sfml_videomode_setbitsperpixel_emS(void* self, unsigned int bits_per_pixel) {
+    CRSFML_PROBE();
     ((VideoMode*)self)->bitsPerPixel = bits_per_pixel;
 }
 void sfml_operator_eq_asWasW(void* left, void* right, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = operator==(*(VideoMode*)left, *(VideoMode*)right);
 }
 void sfml_operator_ne_asWasW(void* left, void* right, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = operator!=(*(VideoMode*)left, *(VideoMode*)right);
 }
 void sfml_operator_lt_asWasW(void* left, void* right, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = operator<(*(VideoMode*)left, *(VideoMode*)right);
 }
 void sfml_operator_gt_asWasW(void* left, void* right, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = operator>(*(VideoMode*)left, *(VideoMode*)right);
 }
 void sfml_operator_le_asWasW(void* left, void* right, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = operator<=(*(VideoMode*)left, *(VideoMode*)right);
 }
 void sfml_operator_ge_asWasW(void* left, void* right, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = operator>=(*(VideoMode*)left, *(VideoMode*)right);
 }
 void sfml_videomode_initialize_asW(void* self, void* copy) {
+    CRSFML_PROBE();
     new(self) VideoMode(*(VideoMode*)copy);
 }
 void sfml_vulkan_allocate(void** result) {
-    *result = malloc(sizeof(Vulkan));
+    CRSFML_PROBE();
+    *result = _Pool<Vulkan>::allocate("Vulkan");
 }
 void sfml_vulkan_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Vulkan>::release(self);
 }
 void sfml_vulkan_isavailable_GZq(Int8 require_graphics, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = Vulkan::isAvailable(require_graphics != 0);
 }
 void sfml_vulkan_getfunction_Yy6(char* name, void* result) {
+    CRSFML_PROBE();
     *(VulkanFunctionPointer*)result = Vulkan::getFunction(name);
 }
 void sfml_vulkan_getgraphicsrequiredinstanceextensions(char*** result, std::size_t* result_size) {
+    CRSFML_PROBE();
     static std::vector<const char*> strs;
     static std::vector<char*> bufs;
     strs = Vulkan::getGraphicsRequiredInstanceExtensions();
@@ -578,192 +767,255 @@ void sfml_vulkan_getgraphicsrequiredinstanceextensions(char*** result, std::size
     *result = &bufs[0];
 }
 void sfml_windowbase_allocate(void** result) {
-    *result = malloc(sizeof(WindowBase));
+    CRSFML_PROBE();
+    *result = _Pool<WindowBase>::allocate("WindowBase");
 }
 void sfml_windowbase_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<WindowBase>::release(self);
 }
 void sfml_windowbase_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) WindowBase();
 }
 void sfml_windowbase_initialize_wg0bQssaL(void* self, void* mode, std::size_t title_size, Uint32* title, Uint32 style) {
+    CRSFML_PROBE();
     new(self) WindowBase(*(VideoMode*)mode, String::fromUtf32(title, title+title_size), style);
 }
 void sfml_windowbase_initialize_rLQ(void* self, WindowHandle handle) {
+    CRSFML_PROBE();
     new(self) WindowBase(handle);
 }
 void sfml_windowbase_finalize(void* self) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->~WindowBase();
 }
 void sfml_windowbase_create_wg0bQssaL(void* self, void* mode, std::size_t title_size, Uint32* title, Uint32 style) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->create(*(VideoMode*)mode, String::fromUtf32(title, title+title_size), style);
 }
 void sfml_windowbase_create_rLQ(void* self, WindowHandle handle) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->create(handle);
 }
 void sfml_windowbase_close(void* self) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->close();
 }
 void sfml_windowbase_isopen(void* self, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((WindowBase*)self)->isOpen();
 }
 void sfml_windowbase_pollevent_YJW(void* self, void* event, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((WindowBase*)self)->pollEvent(*(Event*)event);
 }
 void sfml_windowbase_waitevent_YJW(void* self, void* event, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((WindowBase*)self)->waitEvent(*(Event*)event);
 }
-void sfml_windowbase_getposition(void* self, void* result) {
-    *(Vector2i*)result = ((WindowBase*)self)->getPosition();
+_CVector2i sfml_windowbase_getposition(void* self) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2i>(((WindowBase*)self)->getPosition());
 }
-void sfml_windowbase_setposition_ufV(void* self, void* position) {
-    ((WindowBase*)self)->setPosition(*(Vector2i*)position);
+void sfml_windowbase_setposition_ufV(void* self, _CVector2i position) {
+    CRSFML_PROBE();
+    ((WindowBase*)self)->setPosition(_from_c<Vector2i>(position));
 }
-void sfml_windowbase_getsize(void* self, void* result) {
-    *(Vector2u*)result = ((WindowBase*)self)->getSize();
+_CVector2u sfml_windowbase_getsize(void* self) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2u>(((WindowBase*)self)->getSize());
 }
-void sfml_windowbase_setsize_DXO(void* self, void* size) {
-    ((WindowBase*)self)->setSize(*(Vector2u*)size);
+void sfml_windowbase_setsize_DXO(void* self, _CVector2u size) {
+    CRSFML_PROBE();
+    ((WindowBase*)self)->setSize(_from_c<Vector2u>(size));
 }
 void sfml_windowbase_settitle_bQs(void* self, std::size_t title_size, Uint32* title) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setTitle(String::fromUtf32(title, title+title_size));
 }
 void sfml_windowbase_seticon_emSemS843(void* self, unsigned int width, unsigned int height, Uint8* pixels) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setIcon(width, height, pixels);
 }
 void sfml_windowbase_setvisible_GZq(void* self, Int8 visible) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setVisible(visible != 0);
 }
 void sfml_windowbase_setmousecursorvisible_GZq(void* self, Int8 visible) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setMouseCursorVisible(visible != 0);
 }
 void sfml_windowbase_setmousecursorgrabbed_GZq(void* self, Int8 grabbed) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setMouseCursorGrabbed(grabbed != 0);
 }
 void sfml_windowbase_setmousecursor_Voc(void* self, void* cursor) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setMouseCursor(*(Cursor*)cursor);
 }
 void sfml_windowbase_setkeyrepeatenabled_GZq(void* self, Int8 enabled) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setKeyRepeatEnabled(enabled != 0);
 }
 void sfml_windowbase_setjoystickthreshold_Bw9(void* self, float threshold) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->setJoystickThreshold(threshold);
 }
 void sfml_windowbase_requestfocus(void* self) {
+    CRSFML_PROBE();
     ((WindowBase*)self)->requestFocus();
 }
 void sfml_windowbase_hasfocus(void* self, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((WindowBase*)self)->hasFocus();
 }
 void sfml_windowbase_getsystemhandle(void* self, WindowHandle* result) {
+    CRSFML_PROBE();
     *(WindowHandle*)result = ((WindowBase*)self)->getSystemHandle();
 }
 void sfml_windowbase_createvulkansurface_M35HMp7QC(void* self, void* instance, void* surface, void* allocator, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((WindowBase*)self)->createVulkanSurface(*(VkInstance*)instance, *(VkSurfaceKHR*)surface, (VkAllocationCallbacks*)allocator);
 }
 void sfml_window_allocate(void** result) {
-    *result = malloc(sizeof(Window));
+    CRSFML_PROBE();
+    *result = _Pool<Window>::allocate("Window");
 }
 void sfml_window_free(void* self) {
-    free(self);
+    CRSFML_PROBE();
+    _Pool<Window>::release(self);
 }
 void sfml_window_initialize(void* self) {
+    CRSFML_PROBE();
     new(self) Window();
 }
 void sfml_window_initialize_wg0bQssaLFw4(void* self, void* mode, std::size_t title_size, Uint32* title, Uint32 style, void* settings) {
+    CRSFML_PROBE();
     new(self) Window(*(VideoMode*)mode, String::fromUtf32(title, title+title_size), style, *(ContextSettings*)settings);
 }
 void sfml_window_initialize_rLQFw4(void* self, WindowHandle handle, void* settings) {
+    CRSFML_PROBE();
     new(self) Window(handle, *(ContextSettings*)settings);
 }
 void sfml_window_finalize(void* self) {
+    CRSFML_PROBE();
     ((Window*)self)->~Window();
 }
 void sfml_window_create_wg0bQssaL(void* self, void* mode, std::size_t title_size, Uint32* title, Uint32 style) {
+    CRSFML_PROBE();
     ((Window*)self)->create(*(VideoMode*)mode, String::fromUtf32(title, title+title_size), style);
 }
 void sfml_window_create_wg0bQssaLFw4(void* self, void* mode, std::size_t title_size, Uint32* title, Uint32 style, void* settings) {
+    CRSFML_PROBE();
     ((Window*)self)->create(*(VideoMode*)mode, String::fromUtf32(title, title+title_size), style, *(ContextSettings*)settings);
 }
 void sfml_window_create_rLQ(void* self, WindowHandle handle) {
+    CRSFML_PROBE();
     ((Window*)self)->create(handle);
 }
 void sfml_window_create_rLQFw4(void* self, WindowHandle handle, void* settings) {
+    CRSFML_PROBE();
     ((Window*)self)->create(handle, *(ContextSettings*)settings);
 }
 void sfml_window_close(void* self) {
+    CRSFML_PROBE();
     ((Window*)self)->close();
 }
 void sfml_window_getsettings(void* self, void* result) {
+    CRSFML_PROBE();
     *(ContextSettings*)result = ((Window*)self)->getSettings();
 }
 void sfml_window_setverticalsyncenabled_GZq(void* self, Int8 enabled) {
+    CRSFML_PROBE();
     ((Window*)self)->setVerticalSyncEnabled(enabled != 0);
 }
 void sfml_window_setframeratelimit_emS(void* self, unsigned int limit) {
+    CRSFML_PROBE();
     ((Window*)self)->setFramerateLimit(limit);
 }
 void sfml_window_setactive_GZq(void* self, Int8 active, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Window*)self)->setActive(active != 0);
 }
 void sfml_window_display(void* self) {
+    CRSFML_PROBE();
     ((Window*)self)->display();
 }
 void sfml_window_isopen(void* self, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Window*)self)->isOpen();
 }
 void sfml_window_pollevent_YJW(void* self, void* event, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Window*)self)->pollEvent(*(Event*)event);
 }
 void sfml_window_waitevent_YJW(void* self, void* event, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Window*)self)->waitEvent(*(Event*)event);
 }
-void sfml_window_getposition(void* self, void* result) {
-    *(Vector2i*)result = ((Window*)self)->getPosition();
+_CVector2i sfml_window_getposition(void* self) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2i>(((Window*)self)->getPosition());
 }
-void sfml_window_setposition_ufV(void* self, void* position) {
-    ((Window*)self)->setPosition(*(Vector2i*)position);
+void sfml_window_setposition_ufV(void* self, _CVector2i position) {
+    CRSFML_PROBE();
+    ((Window*)self)->setPosition(_from_c<Vector2i>(position));
 }
-void sfml_window_getsize(void* self, void* result) {
-    *(Vector2u*)result = ((Window*)self)->getSize();
+_CVector2u sfml_window_getsize(void* self) {
+    CRSFML_PROBE();
+    return _to_c<_CVector2u>(((Window*)self)->getSize());
 }
-void sfml_window_setsize_DXO(void* self, void* size) {
-    ((Window*)self)->setSize(*(Vector2u*)size);
+void sfml_window_setsize_DXO(void* self, _CVector2u size) {
+    CRSFML_PROBE();
+    ((Window*)self)->setSize(_from_c<Vector2u>(size));
 }
 void sfml_window_settitle_bQs(void* self, std::size_t title_size, Uint32* title) {
+    CRSFML_PROBE();
     ((Window*)self)->setTitle(String::fromUtf32(title, title+title_size));
 }
 void sfml_window_seticon_emSemS843(void* self, unsigned int width, unsigned int height, Uint8* pixels) {
+    CRSFML_PROBE();
     ((Window*)self)->setIcon(width, height, pixels);
 }
 void sfml_window_setvisible_GZq(void* self, Int8 visible) {
+    CRSFML_PROBE();
     ((Window*)self)->setVisible(visible != 0);
 }
 void sfml_window_setmousecursorvisible_GZq(void* self, Int8 visible) {
+    CRSFML_PROBE();
     ((Window*)self)->setMouseCursorVisible(visible != 0);
 }
 void sfml_window_setmousecursorgrabbed_GZq(void* self, Int8 grabbed) {
+    CRSFML_PROBE();
     ((Window*)self)->setMouseCursorGrabbed(grabbed != 0);
 }
 void sfml_window_setmousecursor_Voc(void* self, void* cursor) {
+    CRSFML_PROBE();
     ((Window*)self)->setMouseCursor(*(Cursor*)cursor);
 }
 void sfml_window_setkeyrepeatenabled_GZq(void* self, Int8 enabled) {
+    CRSFML_PROBE();
     ((Window*)self)->setKeyRepeatEnabled(enabled != 0);
 }
 void sfml_window_setjoystickthreshold_Bw9(void* self, float threshold) {
+    CRSFML_PROBE();
     ((Window*)self)->setJoystickThreshold(threshold);
 }
 void sfml_window_requestfocus(void* self) {
+    CRSFML_PROBE();
     ((Window*)self)->requestFocus();
 }
 void sfml_window_hasfocus(void* self, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Window*)self)->hasFocus();
 }
 void sfml_window_getsystemhandle(void* self, WindowHandle* result) {
+    CRSFML_PROBE();
     *(WindowHandle*)result = ((Window*)self)->getSystemHandle();
 }
 void sfml_window_createvulkansurface_M35HMp7QC(void* self, void* instance, void* surface, void* allocator, Int8* result) {
+    CRSFML_PROBE();
     *(bool*)result = ((Window*)self)->createVulkanSurface(*(VkInstance*)instance, *(VkSurfaceKHR*)surface, (VkAllocationCallbacks*)allocator);
 }
 void sfml_window_version(int* major, int* minor, int* patch) {